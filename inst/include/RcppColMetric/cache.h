@@ -0,0 +1,265 @@
+#include <Rcpp.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "utils.h"
+using namespace Rcpp;
+
+#ifndef RCPP_COLMETRIC_CACHE_MACROS
+#define RCPP_COLMETRIC_CACHE_MACROS
+#ifndef RCPP_COLMETRIC_CACHE_SIZE
+#define RCPP_COLMETRIC_CACHE_SIZE 67108864 // default max number of bytes cached per output type
+#endif
+#define RCPP_COLMETRIC_CACHE_OPTION "RcppColMetric.cache_size" // R option overriding the default
+#endif // RCPP_COLMETRIC_CACHE_MACROS
+
+#ifndef RCPP_COLMETRIC_CACHE_H_GEN_
+#define RCPP_COLMETRIC_CACHE_H_GEN_
+
+namespace RcppColMetric
+{
+  namespace cache
+  {
+    // Vector types that can be hashed by content
+    template <int T>
+    struct is_hashable: std::integral_constant<bool, T == INTSXP || T == REALSXP || T == LGLSXP || T == STRSXP> {};
+
+    // Vector types whose values can be stored outside of R memory
+    template <int T>
+    struct is_storable: std::integral_constant<bool, T == INTSXP || T == REALSXP || T == LGLSXP> {};
+
+    // Content digest of a vector: length, key hash and an independent check hash
+    struct Digest
+    {
+      R_xlen_t n;
+      uint64_t key_hash;
+      uint64_t check_hash;
+    };
+
+    // Cached result of one column, with check hash to verify hits against
+    template <typename T>
+    struct Entry
+    {
+      uint64_t check_hash;
+      std::vector<T> value;
+    };
+
+    // Least-recently-used cache bounded by the (approximate) number of bytes used
+    template <typename T>
+    class LruCache
+    {
+    private:
+      typedef std::pair<uint64_t, Entry<T>> Item;
+      typedef typename std::list<Item>::iterator ItemIter;
+      std::size_t capacity;
+      std::size_t n_byte;
+      std::list<Item> items;
+      std::unordered_map<uint64_t, ItemIter> index;
+      // Bytes used by one entry: list node, hash node and bucket, and stored values
+      static std::size_t entry_bytes(const Entry<T>& entry) {
+        return sizeof(Item) + 2 * sizeof(void*) +
+          sizeof(std::pair<const uint64_t, ItemIter>) + 3 * sizeof(void*) +
+          entry.value.capacity() * sizeof(T);
+      }
+      void evict() {
+        // Evict from the back (least recently used)
+        while (n_byte > capacity && items.empty() == false) {
+          n_byte -= entry_bytes(items.back().second);
+          index.erase(items.back().first);
+          items.pop_back();
+        }
+      }
+    public:
+      LruCache(const std::size_t& capacity_): capacity(capacity_), n_byte(0) {}
+      bool get(const uint64_t& key, const uint64_t& check_hash, std::vector<T>& value) {
+        auto found = index.find(key);
+        if (found == index.end()) {
+          return false;
+        }
+        const Entry<T>& entry = found->second->second;
+        if (entry.check_hash != check_hash) {
+          // Key hash collision: treat as a miss
+          return false;
+        }
+        // Move hit to the front (most recently used)
+        items.splice(items.begin(), items, found->second);
+        value = entry.value;
+        return true;
+      }
+      void put(const uint64_t& key, const Entry<T>& entry) {
+        if (entry_bytes(entry) > capacity) {
+          return;
+        }
+        auto found = index.find(key);
+        if (found != index.end()) {
+          n_byte -= entry_bytes(found->second->second);
+          items.erase(found->second);
+          index.erase(found);
+        }
+        items.emplace_front(key, entry);
+        index[key] = items.begin();
+        n_byte += entry_bytes(items.front().second);
+        evict();
+      }
+      void set_capacity(const std::size_t& capacity_) {
+        capacity = capacity_;
+        evict();
+      }
+      void clear() {
+        items.clear();
+        index.clear();
+        n_byte = 0;
+      }
+      std::size_t size() const {
+        return n_byte;
+      }
+    };
+
+    // Process-wide cache of column results, one per output type
+    template <int T3>
+    inline LruCache<typename traits::storage_type<T3>::type>& result_cache() {
+      static_assert(is_storable<T3>::value,
+                    "RcppColMetric::cache: only integer, numeric and logical results can be cached.");
+      static LruCache<typename traits::storage_type<T3>::type> out(RCPP_COLMETRIC_CACHE_SIZE);
+      return out;
+    }
+
+    inline void clear_all() {
+      result_cache<REALSXP>().clear();
+      result_cache<INTSXP>().clear();
+      result_cache<LGLSXP>().clear();
+    }
+
+    // Total number of bytes cached over all output types
+    inline std::size_t size_all() {
+      return result_cache<REALSXP>().size() + result_cache<INTSXP>().size() + result_cache<LGLSXP>().size();
+    }
+
+    // Max number of bytes cached per output type, from R option or default
+    inline std::size_t get_capacity() {
+      SEXP option = Rf_GetOption1(Rf_install(RCPP_COLMETRIC_CACHE_OPTION));
+      if (Rf_isNull(option) == TRUE) {
+        return RCPP_COLMETRIC_CACHE_SIZE;
+      }
+      if ((TYPEOF(option) != INTSXP && TYPEOF(option) != REALSXP) || Rf_isFactor(option) == TRUE ||
+          Rf_length(option) != 1) {
+        stop("col_metric: option '" RCPP_COLMETRIC_CACHE_OPTION "' must be a single non-negative finite number.");
+      }
+      double capacity = Rf_asReal(option);
+      if (R_FINITE(capacity) == FALSE || capacity < 0) {
+        stop("col_metric: option '" RCPP_COLMETRIC_CACHE_OPTION "' must be a single non-negative finite number.");
+      }
+      if (capacity >= (double) std::numeric_limits<std::size_t>::max()) {
+        return std::numeric_limits<std::size_t>::max();
+      }
+      return (std::size_t) capacity;
+    }
+
+    // FNV-1a hash over raw bytes
+    inline uint64_t hash_bytes(const void* data, const std::size_t& n_byte, uint64_t seed = 14695981039346656037ULL) {
+      const unsigned char* bytes = static_cast<const unsigned char*>(data);
+      for (std::size_t byte_i = 0; byte_i < n_byte; byte_i++) {
+        seed ^= bytes[byte_i];
+        seed *= 1099511628211ULL;
+      }
+      return seed;
+    }
+
+    // Polynomial hash over raw bytes with final avalanche, independent of hash_bytes()
+    inline uint64_t check_bytes(const void* data, const std::size_t& n_byte, uint64_t seed = 0x243F6A8885A308D3ULL) {
+      const unsigned char* bytes = static_cast<const unsigned char*>(data);
+      for (std::size_t byte_i = 0; byte_i < n_byte; byte_i++) {
+        seed = (seed + bytes[byte_i] + 1) * 0x9E3779B97F4A7C15ULL;
+      }
+      seed ^= seed >> 33;
+      seed *= 0xFF51AFD7ED558CCDULL;
+      seed ^= seed >> 33;
+      return seed;
+    }
+
+    // Hash vector content (and its length); atomic vectors are hashed by value
+    template <int T1>
+    inline Digest hash_vector(const Vector<T1>& x) {
+      static_assert(T1 == INTSXP || T1 == REALSXP || T1 == LGLSXP,
+                    "RcppColMetric::cache: only integer, numeric and logical vectors can be hashed by value.");
+      Digest out;
+      out.n = x.length();
+      std::size_t n_byte = out.n * sizeof(typename traits::storage_type<T1>::type);
+      out.key_hash = hash_bytes(x.begin(), n_byte, hash_bytes(&out.n, sizeof(out.n)));
+      out.check_hash = check_bytes(x.begin(), n_byte, check_bytes(&out.n, sizeof(out.n)));
+      return out;
+    }
+
+    // Character vectors are hashed by string content, since CHARSXP addresses may be reused after GC
+    inline void hash_strings(const CharacterVector& x, Digest& out) {
+      for (R_xlen_t str_i = 0; str_i < x.length(); str_i++) {
+        SEXP str_single = STRING_ELT(x, str_i);
+        unsigned char is_na = (str_single == NA_STRING) ? 1 : 0;
+        out.key_hash = hash_bytes(&is_na, 1, out.key_hash);
+        out.check_hash = check_bytes(&is_na, 1, out.check_hash);
+        if (is_na == 0) {
+          const char* str_val = CHAR(str_single);
+          // Include terminating null to separate adjacent strings
+          std::size_t n_byte = strlen(str_val) + 1;
+          out.key_hash = hash_bytes(str_val, n_byte, out.key_hash);
+          out.check_hash = check_bytes(str_val, n_byte, out.check_hash);
+        }
+      }
+    }
+
+    template <>
+    inline Digest hash_vector<STRSXP>(const CharacterVector& x) {
+      Digest out;
+      out.n = x.length();
+      out.key_hash = hash_bytes(&out.n, sizeof(out.n));
+      out.check_hash = check_bytes(&out.n, sizeof(out.n));
+      hash_strings(x, out);
+      return out;
+    }
+
+    // Hash labels, including factor levels if any
+    template <int T2>
+    inline Digest hash_labels(const Vector<T2>& y) {
+      Digest out = hash_vector<T2>(y);
+      if (y.hasAttribute("levels") == true) {
+        CharacterVector y_level = y.attr("levels");
+        hash_strings(y_level, out);
+      }
+      return out;
+    }
+
+    // Combine metric key, label digest and column digest into cache key and check hashes
+    inline Digest combine(const std::string& metric_key, const Digest& y_digest, const Digest& x_digest) {
+      Digest out;
+      out.n = x_digest.n;
+      uint64_t key_part[3] = {hash_bytes(metric_key.c_str(), metric_key.size()), y_digest.key_hash, x_digest.key_hash};
+      uint64_t check_part[3] = {check_bytes(metric_key.c_str(), metric_key.size()), y_digest.check_hash, x_digest.check_hash};
+      out.key_hash = hash_bytes(key_part, sizeof(key_part));
+      out.check_hash = check_bytes(check_part, sizeof(check_part));
+      return out;
+    }
+
+    inline bool use_cache(const Nullable<List>& args) {
+      if (args.isNull() == true) {
+        return false;
+      }
+      List args_ = as<List>(args);
+      if (utils::find_name(args_, "cache") == false) {
+        return false;
+      }
+      SEXP cache_val = args_["cache"];
+      if (TYPEOF(cache_val) != LGLSXP || Rf_length(cache_val) != 1 || LOGICAL(cache_val)[0] == NA_LOGICAL) {
+        stop("col_metric: 'cache' must be a single TRUE or FALSE.");
+      }
+      return LOGICAL(cache_val)[0] == TRUE;
+    }
+  } // namespace: cache
+} // namespace: RcppColMetric
+
+#endif // RCPP_COLMETRIC_CACHE_H_GEN_
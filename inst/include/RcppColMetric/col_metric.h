@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "utils.h"
+#include "cache.h"
 using namespace Rcpp;
 
 #ifndef RCPP_COLMETRIC_H_GEN_
@@ -16,9 +17,58 @@ namespace RcppColMetric
       return R_NilValue;
     };
     virtual Vector<T3> calc_col(const Vector<T1>& x, const Vector<T2>& y, const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const = 0;
+    // Key of all parameters affecting calc_col() for column i; empty string disables caching
+    virtual std::string cache_key(const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const {
+      return "";
+    };
     virtual ~Metric() {}
   };
 
+  namespace cache
+  {
+    // Prepare cache and hash labels once for all cached columns
+    template <int T2, int T3>
+    inline Digest prepare(const Vector<T2>& y, std::true_type) {
+      result_cache<T3>().set_capacity(get_capacity());
+      return hash_labels<T2>(y);
+    }
+
+    template <int T2, int T3>
+    inline Digest prepare(const Vector<T2>& y, std::false_type) {
+      Digest out = {0, 0, 0};
+      return out;
+    }
+
+    // Compute one column, reusing cached result if available
+    template <int T1, int T2, int T3>
+    inline Vector<T3> calc_col(const Metric<T1, T2, T3>& metric, const Vector<T1>& x, const Vector<T2>& y, const R_xlen_t& i,
+                               const Nullable<List>& args, const Digest& y_digest, std::true_type) {
+      std::string metric_key = metric.cache_key(i, args);
+      if (metric_key.empty() == true) {
+        return metric.calc_col(x, y, i, args);
+      }
+      // Hits are verified against an independent check hash of key, labels and column
+      Digest digest = combine(metric_key, y_digest, hash_vector<T1>(x));
+      Entry<typename traits::storage_type<T3>::type> entry;
+      if (result_cache<T3>().get(digest.key_hash, digest.check_hash, entry.value) == true &&
+          (R_xlen_t) entry.value.size() == metric.output_dim) {
+        return Vector<T3>(entry.value.begin(), entry.value.end());
+      }
+      Vector<T3> out = metric.calc_col(x, y, i, args);
+      entry.check_hash = digest.check_hash;
+      entry.value.assign(out.begin(), out.end());
+      result_cache<T3>().put(digest.key_hash, entry);
+      return out;
+    }
+
+    // Types that cannot be hashed or stored are always computed
+    template <int T1, int T2, int T3>
+    inline Vector<T3> calc_col(const Metric<T1, T2, T3>& metric, const Vector<T1>& x, const Vector<T2>& y, const R_xlen_t& i,
+                               const Nullable<List>& args, const Digest& y_digest, std::false_type) {
+      return metric.calc_col(x, y, i, args);
+    }
+  } // namespace: cache
+
   template <int T1, int T2, int T3>
   inline Matrix<T3> col_metric(const RObject& x, const Vector<T2>& y, const Metric<T1, T2, T3>& metric, const Nullable<List>& args = R_NilValue) {
     R_xlen_t n_feature = utils::get_feature_count(x);
@@ -26,12 +76,22 @@ namespace RcppColMetric
     if (n_sample != y.length()) {
       stop("col_metric: length(y) and nrow(X) must be the same.");
     }
+    typedef std::integral_constant<bool, cache::is_hashable<T1>::value && cache::is_hashable<T2>::value &&
+      cache::is_storable<T3>::value> cacheable;
+    bool use_cache = cache::use_cache(args);
+    cache::Digest y_digest = {0, 0, 0};
+    if (use_cache == true) {
+      y_digest = cache::prepare<T2, T3>(y, cacheable());
+    }
     // Derive comparisons
     Matrix<T3> out(metric.output_dim, n_feature);
     for (R_xlen_t feature_i = 0; feature_i < n_feature; feature_i++) {
       Vector<T1> feature_val = utils::slice_feature<T1>(x, feature_i);
-      Vector<T3> out_vec = metric.calc_col(feature_val, y, feature_i, args);
-      out(_, feature_i) = metric.calc_col(feature_val, y, feature_i, args);
+      if (use_cache == true) {
+        out(_, feature_i) = cache::calc_col(metric, feature_val, y, feature_i, args, y_digest, cacheable());
+      } else {
+        out(_, feature_i) = metric.calc_col(feature_val, y, feature_i, args);
+      }
     }
     rownames(out) = metric.row_names(x, y, args);
     colnames(out) = utils::get_feature_names(x);
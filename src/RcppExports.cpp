@@ -37,6 +37,25 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// col_metric_cache_size
+double col_metric_cache_size();
+RcppExport SEXP _RcppColMetric_col_metric_cache_size() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(col_metric_cache_size());
+    return rcpp_result_gen;
+END_RCPP
+}
+// col_metric_cache_clear
+void col_metric_cache_clear();
+RcppExport SEXP _RcppColMetric_col_metric_cache_clear() {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    col_metric_cache_clear();
+    return R_NilValue;
+END_RCPP
+}
 // col_mut_info
 NumericMatrix col_mut_info(const RObject& x, const IntegerVector& y, const Nullable<List>& args);
 RcppExport SEXP _RcppColMetric_col_mut_info(SEXP xSEXP, SEXP ySEXP, SEXP argsSEXP) {
@@ -67,6 +86,8 @@ END_RCPP
 static const R_CallMethodDef CallEntries[] = {
     {"_RcppColMetric_col_auc", (DL_FUNC) &_RcppColMetric_col_auc, 3},
     {"_RcppColMetric_col_auc_vec", (DL_FUNC) &_RcppColMetric_col_auc_vec, 3},
+    {"_RcppColMetric_col_metric_cache_size", (DL_FUNC) &_RcppColMetric_col_metric_cache_size, 0},
+    {"_RcppColMetric_col_metric_cache_clear", (DL_FUNC) &_RcppColMetric_col_metric_cache_clear, 0},
     {"_RcppColMetric_col_mut_info", (DL_FUNC) &_RcppColMetric_col_mut_info, 3},
     {"_RcppColMetric_col_mut_info_vec", (DL_FUNC) &_RcppColMetric_col_mut_info_vec, 3},
     {NULL, NULL, 0}
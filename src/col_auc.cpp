@@ -92,7 +92,23 @@ public:
     }
     return comp_name;
   }
+  // Derive direction for feature i
+  String get_direction(const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const {
+    String direction = "auto";
+    if (args.isNotNull() == true) {
+      List args_ = as<List>(args);
+      if (RcppColMetric::utils::find_name(args_, "direction") == true) {
+        CharacterVector direction_vec = args_["direction"];
+        if (direction_vec.length() == 0) {
+          stop("col_auc: 'direction' must contain at least 1 direction.");
+        }
+        direction = GETV(direction_vec, i);
+      }
+    }
+    return direction;
+  }
   virtual NumericVector calc_col(const NumericVector& x, const IntegerVector& y, const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const override {
+    String direction = get_direction(i, args);
     // Apply Wilcoxon algorithm
     NumericVector out(output_dim);
     for (R_xlen_t comp_i = 0; comp_i < comp_list.length(); comp_i++) {
@@ -108,14 +124,6 @@ public:
         NumericVector feature_val_rank = avg_rank(feature_val_comp);
         NumericVector feature_val_rank_from = feature_val_rank[seq(0, n_from - 1)];
         double auc = (sum(feature_val_rank_from) - n_from * (n_from + 1) / 2) / (n_from * n_to);
-        String direction = "auto";
-        if (args.isNotNull() == true) {
-          List args_ = as<List>(args);
-          if (RcppColMetric::utils::find_name(args_, "direction") == true) {
-            CharacterVector direction_vec = args_["direction"];
-            direction = GETV(direction_vec, i);
-          }
-        }
         if (direction == ">") {
           out(comp_i) = auc;
         } else if (direction == "<") {
@@ -130,6 +138,9 @@ public:
     }
     return out;
   }
+  virtual std::string cache_key(const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const override {
+    return "auc:" + std::string(get_direction(i, args).get_cstring());
+  }
 };
 
 //' Column-wise area under ROC curve (AUC)
@@ -141,6 +152,9 @@ public:
 //' @param args \code{NULL} (default) or list of named arguments: \describe{
 //' \item{direction}{Character vector containing one of the following directions: \code{">"}, \code{"<"} or \code{"auto"} (default),
 //' recycled for each feature so different directions can be used for different features.}
+//' \item{cache}{Logical indicating whether to reuse results of unchanged columns from previous calls (default: \code{FALSE}).
+//' Each column result is cached by a hash of the column content, \code{y} and the other arguments above,
+//' in a process-wide least-recently-used cache bounded by option \code{RcppColMetric.cache_size} (see \code{\link{col_metric_cache_size}}).}
 //' }
 //'
 //' @return An output is a single matrix with the same number of columns as X and "n choose 2" ( n!/((n-2)! 2!) = n(n-1)/2 ) number of rows,
@@ -151,6 +165,7 @@ public:
 //' @note Change log:
 //' \itemize{
 //'   \item{0.1.0 Xiurui Zhu - Initiate the function.}
+//'   \item{0.1.1 Xiurui Zhu - Add \code{cache} argument.}
 //' }
 //'
 //' @export
@@ -175,6 +190,7 @@ AucMetric gen_auc_metric(const RObject& x, const IntegerVector& y, const Nullabl
 //' @note Change log:
 //' \itemize{
 //'   \item{0.1.0 Xiurui Zhu - Initiate the function.}
+//'   \item{0.1.1 Xiurui Zhu - Support \code{cache} argument.}
 //' }
 //'
 //' @export
@@ -0,0 +1,32 @@
+#include <Rcpp.h>
+#include "../inst/include/RcppColMetric.h"
+using namespace Rcpp;
+
+//' Cache of column-wise metric results
+//'
+//' Inspect or clear the process-wide cache used when column-wise metric functions are called with \code{args = list(cache = TRUE)}.
+//' The cache keeps up to about \code{getOption("RcppColMetric.cache_size", 67108864)} bytes per output type
+//' and evicts the least recently used column results beyond that.
+//'
+//' @return \code{col_metric_cache_size()} returns the approximate number of bytes used by cached column results, in the same unit as option \code{RcppColMetric.cache_size}.
+//' \code{col_metric_cache_clear()} is called for its side effect of emptying the cache and returns \code{NULL} invisibly.
+//'
+//' @note Change log:
+//' \itemize{
+//'   \item{0.1.1 Xiurui Zhu - Initiate the function.}
+//' }
+//'
+//' @export
+//' @seealso \code{\link{col_auc}} and \code{\link{col_mut_info}} for the cached functions.
+//' @example man-roxygen/ex-col_metric_cache.R
+// [[Rcpp::export]]
+double col_metric_cache_size() {
+  return (double) RcppColMetric::cache::size_all();
+}
+
+//' @rdname col_metric_cache_size
+//' @export
+// [[Rcpp::export]]
+void col_metric_cache_clear() {
+  RcppColMetric::cache::clear_all();
+}
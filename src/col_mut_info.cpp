@@ -118,6 +118,9 @@ public:
     NumericVector out(output_dim, res);
     return out;
   }
+  virtual std::string cache_key(const R_xlen_t& i, const Nullable<List>& args = R_NilValue) const override {
+    return "mut_info:" + std::to_string(method);
+  }
 };
 
 //' Column-wise mutual information
@@ -130,6 +133,9 @@ public:
 //' @param args \code{NULL} (default) or list of named arguments: \describe{
 //' \item{method}{Integer indicating computation method: 0 = empirical, 1 = Miller-Madow,
 //' 2 = shrink, 3 = Schurmann-Grassberger.}
+//' \item{cache}{Logical indicating whether to reuse results of unchanged columns from previous calls (default: \code{FALSE}).
+//' Each column result is cached by a hash of the column content, \code{y} and the other arguments above,
+//' in a process-wide least-recently-used cache bounded by option \code{RcppColMetric.cache_size} (see \code{\link{col_metric_cache_size}}).}
 //' }
 //'
 //' @return An output is a single matrix with the same number of columns as X and 1 row.
@@ -137,6 +143,7 @@ public:
 //' @note Change log:
 //' \itemize{
 //'   \item{0.1.0 Xiurui Zhu - Initiate the function.}
+//'   \item{0.1.1 Xiurui Zhu - Add \code{cache} argument.}
 //' }
 //'
 //' @export
@@ -176,6 +183,7 @@ MutInfoMetric gen_mut_info_metric(const RObject& x, const IntegerVector& y, cons
 //' @note Change log:
 //' \itemize{
 //'   \item{0.1.0 Xiurui Zhu - Initiate the function.}
+//'   \item{0.1.1 Xiurui Zhu - Support \code{cache} argument.}
 //' }
 //'
 //' @export